@@ -27,6 +27,7 @@ namespace sofs21
 
        SOInode* p = soGetInodePointer(pih);
        SODirectorySlot d[DPB]; //array of directory slots
+       SODirectorySlot fd[DPB]; //copy of the block holding the first empty slot
 
        bool isEmpty = false;
        uint32_t bloco;
@@ -51,6 +52,7 @@ namespace sofs21
                     bloco = i;
                     entrada = j;
                     isEmpty = true;
+                    memcpy(fd, d, BlockSize); // keep it, so it need not be read again
                 }
 
             //     char bbbb[31];
@@ -65,10 +67,9 @@ namespace sofs21
 
         if(isEmpty)
         {
-            soReadInodeBlock(pih,bloco,d);
-            strncpy(d[entrada].nameBuffer,name,DIRECTORY_SLOT);
-            d[entrada].in= cin;
-            soWriteInodeBlock(pih,bloco,d);
+            strncpy(fd[entrada].nameBuffer,name,DIRECTORY_SLOT);
+            fd[entrada].in= cin;
+            soWriteInodeBlock(pih,bloco,fd);
         } else {
             bloco = soAllocInodeBlock(pih, totalBlocks);
             strncpy(d[0].nameBuffer, name,DIRECTORY_SLOT);
@@ -80,8 +81,8 @@ namespace sofs21
           }
             soWriteDataBlock(bloco,d);
             p->size+= BlockSize;
+            soSaveInode(pih); // size grew; the block refs were already saved by soAllocInodeBlock
         }
-        soSaveInode(pih); 
 
        // binAddDirentry(pih, name, cin);
     }
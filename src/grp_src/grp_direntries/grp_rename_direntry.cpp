@@ -21,7 +21,9 @@ namespace sofs21
 
        SOInode* p = soGetInodePointer(pih);
        SODirectorySlot d[DPB]; //array of directory slots
+       SODirectorySlot fd[DPB]; //copy of the block holding the entry
 
+       bool found = false;
        uint32_t bloco;
        uint16_t entrada;
        // uint32_t bloco = (pin -> BlockSize/sizeof(SODirectorySlot))/RPB
@@ -38,13 +40,17 @@ namespace sofs21
                 if (strncmp(d[j].nameBuffer,name,DIRECTORY_SLOT)==0) {
                     bloco = i;
                     entrada = j;
+                    found = true;
+                    memcpy(fd, d, BlockSize); // edit this block, not a blank one
                 }
             }
         }
 
-        SODirectorySlot novo [DPB];
+        if (!found) {
+            throw SOException(ENOENT,__FUNCTION__);
+        }
 
-        strncpy(novo[entrada].nameBuffer,newName,DIRECTORY_SLOT);
-        soWriteInodeBlock(pih,bloco,novo);
+        strncpy(fd[entrada].nameBuffer,newName,DIRECTORY_SLOT);
+        soWriteInodeBlock(pih,bloco,fd);
     }
 };
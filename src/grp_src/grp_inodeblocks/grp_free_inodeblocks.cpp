@@ -40,13 +40,15 @@ namespace sofs21
         //Alexandre Ferreira Martins Paiva 89908
 
         SOInode* ip = soGetInodePointer(ih);
+        uint32_t blkcnt = ip->blkcnt;//Só guardar o inode se algum bloco foi libertado
 
         //Libertar blocos diretamente referenciados
         for(uint32_t i = 0; i < N_DIRECT; i++) {
             if(i>=ffbn) {
                 if (ip->d[i] != NullBlockReference) {
-                    soFreeDataBlock[ip->d[i]];
+                    soFreeDataBlock(ip->d[i]);
                     ip->d[i] = NullBlockReference;
+                    ip->blkcnt--;
                 }
             }
         }
@@ -57,6 +59,7 @@ namespace sofs21
             if (tr == true) {
                 soFreeDataBlock(ip->i1);
                 ip->i1=NullBlockReference;
+                ip->blkcnt--;
             }
         }
         
@@ -66,10 +69,13 @@ namespace sofs21
             if (tr == true) {
                 soFreeDataBlock(ip->i2);
                 ip->i2=NullBlockReference;
+                ip->blkcnt--;
             }
         }
 
-        soSaveInode(ih);
+        if (ip->blkcnt != blkcnt) {
+            soSaveInode(ih);
+        }
     }
 
     /* ********************************************************* */
@@ -97,6 +103,7 @@ namespace sofs21
                 if (r != NullBlockReference) {//Se ainda não estiver limpa, limpar a mesma
                     soFreeDataBlock(r);//Libertar o data block referenciado
                     refs[i] = NullBlockReference;//Limpar a referência no data block
+                    ip->blkcnt--;
                     limpou = true;
                 }
             }
@@ -146,10 +153,13 @@ namespace sofs21
                                 if (r != NullBlockReference) {
                                     soFreeDataBlock(r);//Libertar o data block referenciado
                                     refs4[k] = NullBlockReference;//Limpar a referência no data block
+                                    ip->blkcnt--;
                                 }
                             }
                             soWriteDataBlock(refs2[i], refs4);//Não precisamos de uma variável 'limpou' como no indirect pois sabemos que
                                                               //este irá ser modificado de certeza
+                            soFreeDataBlock(refs2[i]);//O bloco de referências ficou vazio, libertá-lo também
+                            ip->blkcnt--;
                             refs2[i]=NullBlockReference;
                             limpou=true;
                         }
@@ -165,10 +175,13 @@ namespace sofs21
                                 if (r != NullBlockReference) {
                                     soFreeDataBlock(r);//Libertar o data block referenciado
                                     refs4[k] = NullBlockReference;//Limpar a referência no data block
+                                    ip->blkcnt--;
                                 }
                             }
                             soWriteDataBlock(refs2[i], refs4);//Não precisamos de uma variável 'limpou' como no indirect pois sabemos que
                                                               //este irá ser modificado de certeza
+                            soFreeDataBlock(refs2[i]);//O bloco de referências ficou vazio, libertá-lo também
+                            ip->blkcnt--;
                             refs2[i]=NullBlockReference;
                             limpou=true;
                         }
@@ -182,6 +195,7 @@ namespace sofs21
                                 if (r != NullBlockReference) {
                                     soFreeDataBlock(r);//Libertar o data block referenciado
                                     refs7[i] = NullBlockReference;//Limpar a referência no data block
+                                    ip->blkcnt--;
                                 }
                             }
                             soWriteDataBlock(refs2[nBlocos], refs7);
@@ -194,6 +208,8 @@ namespace sofs21
                                 }
                             }
                             if (naoVazio == false) {//Se o bloco ficou totalmente vazio, então libertar o bloco em si
+                                soFreeDataBlock(refs2[nBlocos]);
+                                ip->blkcnt--;
                                 refs2[nBlocos]=NullBlockReference;
                             }
                             limpou=true;
@@ -80,7 +80,6 @@ namespace sofs21
 
         soSaveInode(inodeHandler);
         soCloseInode(inodeHandler);
-        soSaveSuperblock();
 
         return inodeID;
     }
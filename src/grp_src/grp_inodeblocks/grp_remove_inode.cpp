@@ -24,7 +24,6 @@ namespace sofs21
             auto rih = soOpenInode(rin);
             auto* prin = soGetInodePointer(rih);
             soFreeInodeBlocks(rih, prin->d[0]);
-            soSaveInode(rih);
             soCloseInode(rih);
             soFreeInode(rin);
         }